@@ -406,6 +406,11 @@ thread_active(thread_os_t thread);
 extern thread_os_t
 thread_self(void);
 
+/*! Wait for the thread to finish and release it (it can not be used again)
+ *  - returns FALSE if that is not possible */
+extern bool
+thread_wait(thread_os_t thread);
+
 
 /*          O/S Independence - Time                              */
 
@@ -416,12 +421,19 @@ thread_self(void);
  */
     
 /*! starting number of ticks (reading when program starts)
+ *  This is the reading for the thread that initialized the library: use
+ *  sys_ticks_start_get() for the calling thread's.
  */
 extern number_t sys_ticks_start;
 /*! last return from sys_ticks_hz (normally this value does not change
  *  dynamically)
  */
 extern number_t sys_ticks_hz_last;
+
+extern number_t
+sys_ticks_start_get(void);
+extern number_t
+sys_ticks_hz_last_get(void);
     
 /*! read the current number of elapsed ticks
  */
@@ -778,7 +790,7 @@ typedef struct valpool_s valpool_t;
 typedef struct value_s value_t;
 
 
-/*! Remove a value from any double linked chain it is on
+/*! Remove a value from the local handle holding it (if any)
  */
 extern void value_extract(value_t *val);
 
@@ -786,11 +798,11 @@ extern void value_extract(value_t *val);
 /*! To try to isolate uncommitted values (i.e. ones that are valid but which
  *  should not be garbage collected yet, we use the notion of a value being
  *  'local' (local == not reachable from garbage collection root).  Most new
- *  values are allocated 'local' by placing them on a chained list of values
- *  which will not normally be garbage collected (because the list is marked
- *  during the live-marking process).  Once a value is known to be "safe" inside
- *  another data structure it can be "un-localled" by removing it from this
- *  list.
+ *  values are allocated 'local' by placing them in a handle on a stack of
+ *  values which will not normally be garbage collected (because the stack is
+ *  marked during the live-marking process).  Once a value is known to be
+ *  "safe" inside another data structure it can be "un-localled" by emptying
+ *  its handle.
  *  Ideally every new value will be un-localed before it leaves the scope of the
  *  routine that consumes it (value_unlocal() can be used, below).
  *  The hope here is to enable the garbage collector to be run relatively
@@ -824,9 +836,14 @@ typedef value_coroutine_t parser_state_t;
 
 /*! Default value pool where values unattached to the environment can be placed
     to survive garbage collection
+    This is the pool of the thread that initialized the library: each thread
+    has its own, which root_state_get() returns.
 */
 extern parser_state_t *root_state;    
 
+extern parser_state_t *
+root_state_get(void);
+
 
 /*          Values                                       */
 
@@ -1100,6 +1117,17 @@ value_code_lnew(parser_state_t *state, const value_t *string,
 extern bool
 value_code_buf(const value_t *value, const char **out_buf, size_t *out_len);
 
+/*! How the text of code bodies is executed */
+typedef enum
+{   code_exec_text,     /**< parse the text every time */
+    code_exec_tree,     /**< walk a tree compiled from the text */
+    code_exec_vm        /**< run bytecode compiled from the tree */
+} code_exec_mode_t;
+
+/*! Set how code bodies are executed - the results should not differ */
+extern void
+code_exec_mode_set(code_exec_mode_t mode);
+
 
 /*          Stream Values                                                    */
 
@@ -1970,6 +1998,42 @@ parser_collect_async(parser_state_t *state);
 extern void
 parser_collect(parser_state_t *state);
 
+/*! Collect all the garbage in all known coroutines now
+ *  keeping local variables allocated in each of them
+ */
+extern void
+parser_collect_full(parser_state_t *state);
+
+/*! Parameters that determine when garbage is collected
+ *  The calls above collect only when the heap has grown enough to be worth it
+ */
+typedef struct
+{   size_t young;    /**< values allocated before a collection is made */
+    size_t growth;   /**< percentage growth of the old values that causes a
+                          full collection */
+    size_t limit;    /**< heap values at which every collection is full and
+                          beyond which allocation fails (0 for no limit) */
+} heap_config_t;
+
+/*! Garbage collection statistics */
+typedef struct
+{   size_t values;      /**< values on the heap */
+    size_t allocated;   /**< values allocated since the last collection */
+    size_t bytes;       /**< bytes allocated since the last collection */
+    size_t collections; /**< collections made */
+    size_t full;        /**< full collections made */
+    size_t slabs;       /**< blocks of storage holding small values */
+} heap_stats_t;
+
+extern void
+value_heap_config_get(heap_config_t *out_config);
+
+extern void
+value_heap_config_set(const heap_config_t *config);
+
+extern void
+value_heap_stats(heap_stats_t *out_stats);
+
 /*! Write the macro-expanded version of a phrase to an output
  *  @return FALSE if the phrase was incomplete in terms of macro expansion
  */
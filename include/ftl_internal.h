@@ -59,6 +59,18 @@ extern "C" {
 #define FTL_FREE   free
 
 
+/*          Threads                      		                     */
+
+/*! Storage class for data that each thread must have its own copy of
+ *  (e.g. the value heap, so that each thread can run its own interpreters)
+ */
+#ifdef _MSC_VER
+#define FTL_THREAD_LOCAL __declspec(thread)
+#else
+#define FTL_THREAD_LOCAL __thread
+#endif
+
+
 /*          Character Sinks              		                     */
 
 
@@ -114,18 +126,21 @@ typedef const value_t *value_parse_fn_t(const char **ref_line,
 typedef int value_cmp_fn_t(const value_t *v1, const value_t *v2);
 
 struct value_s
-{   /* local chain for garbage collection */
-    struct value_s *loc_next;   /**< ref to next value on chain */
-    struct value_s **loc_last_ref; /**< ref to last value's "loc_next" link */
+{   /* local handle for garbage collection */
+    struct value_s **loc_slot;  /**< handle holding value if it is local */
     /* main value fields */
     struct value_s *link;       /**< multipurpose "next" link */
     struct value_s *heap_next;  /**< next value allocated in heap */
+    const value_type_t *kind;	/**< type of this value */
+    /* the remaining fields share a single pointer-sized word (unless
+       FTL_VAL_HAS_LINENO adds a line number to them) */
     int heap_version;	        /**< last heap version this was a member of */
 #ifdef FTL_VAL_HAS_LINENO
     int lineno;                 /**< used only for debugging */
 #endif
-    const value_type_t *kind;	/**< type of this value */
     unsigned char on_heap;      /**< if set don't delete it with kind->del */
+    unsigned char heap_gen;     /**< garbage collection generation flags */
+    unsigned char heap_class;   /**< storage size class (0 if malloc'd) */
 } /* value_t */;
 
 /*! Initialize a value data structure
@@ -242,6 +257,9 @@ struct dir_s
     dir_get_fn_t    *get   ; /* find corresponding value */
     dir_forall_fn_t *forall; /* ennumerate values */
     dir_count_fn_t  *count;  /* quick count of the number of values */
+    /* added after the original members so that their offsets are unchanged
+       for code built against an earlier version of this header */
+    bool defines_ops;        /* holds operator definitions parsing uses */
 } /* dir_t */;
 
 #define dir_value(dir) (&(dir)->value)
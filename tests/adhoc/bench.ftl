@@ -0,0 +1,56 @@
+# Definitions shared by the benchmarks in this directory.
+#
+# A benchmark loads them with
+#     source bench.ftl
+# so it must be run from this directory (or with it on FTL_PATH).
+
+set printf io.fprintf io.out
+
+# milliseconds in <ticks>
+set ms[ticks]:{ ticks * 1000 / sys.ticks_hz }
+
+# ticks taken by <n> executions of <code> (given 1 .. <n>)
+set timeloop[n, code]:{
+    .start = sys.ticks!;
+    for <1..n> code!;
+    (sys.ticks!) - start
+}
+
+# the result of <fn>! and the milliseconds it took
+set timed[fn]:{
+    .start = sys.ticks!;
+    .val = fn!;
+    [ms = ms ((sys.ticks!) - start)!, val = val]
+}
+
+# the number of values allocated by <fn>! and the bytes they took
+# (nothing is collected meanwhile)
+set allocated[fn]:{
+    .young = sys.gc.config.young;
+    sys.gc.collect!;
+    sys.gc.config.young = 1000000000;
+    .values = 0+sys.gc.stats.allocated;
+    .bytes = 0+sys.gc.stats.bytes;
+    fn!;
+    values = (sys.gc.stats.allocated) - values;
+    bytes = (sys.gc.stats.bytes) - bytes;
+    sys.gc.config.young = young;
+    [values = values, bytes = bytes]
+}
+
+# the most memory this process has used so far in kB (0 without /proc)
+set peakrss[]:{
+    .f = io.file "/proc/self/status" "r"!;
+    .kb = 0;
+    if f != NULL {
+        forall (split "\n" (io.read f 4096!)!) [line]:{
+            .po = parse.scan line!;
+            if (parse.scanmatch ["VmHWM:"=NULL] [x]:{} po!) {
+                parse.scanwhite po!;
+                parse.scanintval @kb po!;
+            } {}!;
+        }!;
+        io.close f!;
+    } {}!;
+    kb
+}
@@ -0,0 +1,43 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken to call builtin functions taking one, two and
+# three arguments, both as functions and (for two) through an operator.
+#
+# usage: ftl builtincall.ftl
+
+source bench.ftl
+
+set calls 64000
+
+set s "abcdef"
+
+# <code> makes 16 calls
+set report[name, code]:{
+    printf "%-10s %5dms for %d calls\n"
+           <name, ms (timeloop calls/16 code!)!, calls>!;
+}
+
+report "strlen" [i]:{
+    <strlen s, strlen s, strlen s, strlen s, strlen s, strlen s, strlen s,
+     strlen s, strlen s, strlen s, strlen s, strlen s, strlen s, strlen s,
+     strlen s, strlen s>
+}
+report "add" [i]:{
+    <add i 1, add i 2, add i 3, add i 4, add i 5, add i 6, add i 7, add i 8,
+     add i 1, add i 2, add i 3, add i 4, add i 5, add i 6, add i 7, add i 8>
+}
+report "+" [i]:{
+    <i+1, i+2, i+3, i+4, i+5, i+6, i+7, i+8,
+     i+1, i+2, i+3, i+4, i+5, i+6, i+7, i+8>
+}
+report "equal" [i]:{
+    <equal i 1, equal i 2, equal i 3, equal i 4, equal i 5, equal i 6,
+     equal i 7, equal i 8, equal i 1, equal i 2, equal i 3, equal i 4,
+     equal i 5, equal i 6, equal i 7, equal i 8>
+}
+report "if" [i]:{
+    <if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2},
+     if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2},
+     if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2},
+     if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2}, if TRUE {1} {2}>
+}
@@ -0,0 +1,45 @@
+#!/usr/bin/env ftl
+
+# Benchmark: many socket connections served at once by coroutines in one
+# thread.
+#
+# Each of 'pairs' servers listens on its own port and echoes what it reads
+# back to a client that sends it 'msgs' messages - all of them wait for their
+# sockets at the same time.
+#
+# usage: ftl co_echo.ftl
+
+source bench.ftl
+
+set pairs 100
+set msgs 20
+set base 47400
+
+set server [port]:{
+    .s = io.listen "tcp" (strf "%d" <port>!) "rw"!;
+    .more = TRUE;
+    while {more} {
+        .data = io.read s 100!;
+        more = if data == NULL {FALSE} {data != ""}!;
+        if more { io.write s data!; } {}!;
+    }!;
+    io.close s!;
+}
+
+set replies 0
+set client [port]:{
+    .c = io.connect "tcp" (strf "127.0.0.1:%d" <port>!) "rw"!;
+    for <1..msgs> [i]:{
+        io.write c (strf "message %d" <i>!)!;
+        .r = io.read c 100!;
+        if r != NULL { replies = replies + 1; } {}!;
+    }!;
+    io.close c!;
+}
+
+set t timed {
+    for <0..(pairs-1)> [p]:{ co.go (server base+p)!; }!;
+    for <0..(pairs-1)> [p]:{ co.go (client base+p)!; }!;
+    co.run!
+}!
+printf "%d replies in %dms\n" <replies, t.ms>
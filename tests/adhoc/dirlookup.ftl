@@ -0,0 +1,53 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken to look up names in an identifier directory
+# should not depend on the number of names it holds.
+#
+# The time for a loop that does not look anything up is subtracted, since
+# the cost of garbage collection grows with the size of the directory.
+#
+# usage: ftl dirlookup.ftl
+
+source bench.ftl
+
+set lookups 64000
+
+# build a directory with names "n1" .. "n<size>"
+set mkdir[size]:{
+    .d = [];
+    for <1..size> [i]:{ d.(strf "n%d" <i>!) = i; }!;
+    d
+}
+
+# time <lookups> retrievals of names near the end of <d>
+# (each loop iteration executes a single expression with 64 look-ups)
+set timelookups[d, size]:{
+    .last = strf "n%d" <size>!;
+    .first = strf "n%d" <size-1>!;
+    .looked = timeloop lookups/64 [i]:{
+        <d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first),
+         d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first),
+         d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first),
+         d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first),
+         d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first),
+         d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first),
+         d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first),
+         d.(last), d.(first), d.(last), d.(first), d.(last), d.(first), d.(last), d.(first)>
+    }!;
+    looked - (timeloop lookups/64 [i]:{
+        <(last), (first), (last), (first), (last), (first), (last), (first),
+         (last), (first), (last), (first), (last), (first), (last), (first),
+         (last), (first), (last), (first), (last), (first), (last), (first),
+         (last), (first), (last), (first), (last), (first), (last), (first),
+         (last), (first), (last), (first), (last), (first), (last), (first),
+         (last), (first), (last), (first), (last), (first), (last), (first),
+         (last), (first), (last), (first), (last), (first), (last), (first),
+         (last), (first), (last), (first), (last), (first), (last), (first)>
+    }!)
+}
+
+forall <10, 100, 1000, 10000> [size]:{
+    .d = mkdir size!;
+    printf "%6d names: %5dms for %d lookups\n"
+           <size, ms (timelookups d size!)!, lookups>!;
+}
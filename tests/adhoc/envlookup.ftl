@@ -0,0 +1,39 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken to refer to a name defined in the outermost
+# environment, compared with a name local to the function referring to it.
+#
+# usage: ftl envlookup.ftl
+
+source bench.ftl
+
+set refs 640000
+
+set glob 1
+
+# time <refs> references to "glob" (64 in each loop iteration)
+set timeglobal[]:{
+    timeloop refs/64 [i]:{
+        <glob, glob, glob, glob, glob, glob, glob, glob,
+         glob, glob, glob, glob, glob, glob, glob, glob,
+         glob, glob, glob, glob, glob, glob, glob, glob,
+         glob, glob, glob, glob, glob, glob, glob, glob,
+         glob, glob, glob, glob, glob, glob, glob, glob,
+         glob, glob, glob, glob, glob, glob, glob, glob,
+         glob, glob, glob, glob, glob, glob, glob, glob,
+         glob, glob, glob, glob, glob, glob, glob, glob>
+    }!
+}
+
+# time <refs> references to the loop's own argument
+set timelocal[]:{
+    timeloop refs/64 [i]:{
+        <i, i, i, i, i, i, i, i, i, i, i, i, i, i, i, i,
+         i, i, i, i, i, i, i, i, i, i, i, i, i, i, i, i,
+         i, i, i, i, i, i, i, i, i, i, i, i, i, i, i, i,
+         i, i, i, i, i, i, i, i, i, i, i, i, i, i, i, i>
+    }!
+}
+
+printf "global: %5dms for %d references\n" <ms (timeglobal!)!, refs>
+printf "local:  %5dms for %d references\n" <ms (timelocal!)!, refs>
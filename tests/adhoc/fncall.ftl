@@ -0,0 +1,49 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the number of calls per second made to FTL functions taking
+# from one to four arguments, and the values allocated by each call made in
+# a loop.
+#
+# usage: ftl fncall.ftl
+
+source bench.ftl
+
+set calls 64000
+
+set f1[a]:{a}
+set f2[a,b]:{a}
+set f3[a,b,c]:{a}
+set f4[a,b,c,d]:{a}
+
+# <code> makes 8 calls
+set report[args, code]:{
+    .ticks = timeloop calls/8 code!;
+    printf "%d argument%s %8d calls/s\n"
+           <args, if (args == 1) {""} {"s"}!,
+            calls * sys.ticks_hz / (if (ticks == 0) {1} {ticks}!)>!;
+}
+
+report 1 [i]:{
+    <f1 i!, f1 i!, f1 i!, f1 i!, f1 i!, f1 i!, f1 i!, f1 i!>
+}
+report 2 [i]:{
+    <f2 i 2!, f2 i 2!, f2 i 2!, f2 i 2!, f2 i 2!, f2 i 2!, f2 i 2!, f2 i 2!>
+}
+report 3 [i]:{
+    <f3 i 2 3!, f3 i 2 3!, f3 i 2 3!, f3 i 2 3!,
+     f3 i 2 3!, f3 i 2 3!, f3 i 2 3!, f3 i 2 3!>
+}
+report 4 [i]:{
+    <f4 i 2 3 4!, f4 i 2 3 4!, f4 i 2 3 4!, f4 i 2 3 4!,
+     f4 i 2 3 4!, f4 i 2 3 4!, f4 i 2 3 4!, f4 i 2 3 4!>
+}
+
+# values allocated for each of <n> calls made by <code>
+set percall[name, n, code]:{
+    .a = allocated code!;
+    printf "%-20s %6d values/call\n" <name, a.values / n>!;
+}
+
+percall "1 argument" calls []:{ for <1..calls> [i]:{ f1 i!; 0 }! }
+percall "1 argument (tail)" calls []:{ for <1..calls> [i]:{ f1 i! }! }
+percall "4 arguments (tail)" calls []:{ for <1..calls> [i]:{ f4 i 2 3 4! }! }
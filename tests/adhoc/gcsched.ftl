@@ -0,0 +1,22 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the number of garbage collections made by a loop, and the time
+# it takes, for different numbers of values allocated between collections
+# (sys.gc.config.young).  A value of zero collects whenever it is possible.
+#
+# usage: ftl gcsched.ftl
+
+source bench.ftl
+
+set iterations 20000
+
+forall <0, 256, 1024, 4096, 16384> [young]:{
+    .was = sys.gc.config.young;
+    sys.gc.config.young = young;
+    .collections = 0+sys.gc.stats.collections;
+    .took = timeloop iterations [i]:{ [n=i, sq=i*i, name="v$i"] }!;
+    sys.gc.config.young = was;
+    printf "young %5d: %5d collections %5dms for %d iterations\n"
+           <young, (sys.gc.stats.collections) - collections, ms took!,
+            iterations>!;
+}
@@ -0,0 +1,30 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken by a loop that allocates only short-lived values
+# should not depend on how many long-lived values the heap already holds.
+#
+# Garbage can be collected after any expression in a loop body, so when every
+# collection visits the whole heap the loop slows in proportion to the number
+# of values kept in "keep".
+#
+# usage: ftl gcyoung.ftl
+
+source bench.ftl
+
+set iterations 20000
+
+# build a vector of <size> small directories
+set mkkeep[size]:{
+    .v = <>;
+    for <1..size> [i]:{ v.(i) = [n=i, name="k$i"]; }!;
+    v
+}
+
+# a loop iteration that builds a small directory
+set iteration[i]:{ [n=i, sq=i*i, name="v$i"] }
+
+forall <0, 1000, 10000, 20000> [size]:{
+    .keep = mkkeep size!;
+    printf "%6d kept values: %5dms for %d iterations\n"
+           <size, ms (timeloop iterations iteration!)!, iterations>!;
+}
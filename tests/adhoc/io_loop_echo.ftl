@@ -0,0 +1,53 @@
+#!/usr/bin/env ftl
+
+# Benchmark: many socket connections served at once by one event loop.
+#
+# One server port accepts 'clients' connections and echoes what it reads on
+# each of them.  Each client sends 'msgs' one character messages, the next
+# when the last has been echoed - the server and the clients are all
+# functions called by io.loop.run when their sockets are ready.
+#
+# usage: ftl io_loop_echo.ftl
+
+source bench.ftl
+
+set clients 1000
+set msgs 20
+set port "47500"
+
+set server io.loop.accept "tcp" port "rw" [conn]:{
+    io.loop.read conn [s]:{
+        .data = io.read s 100!;
+        .more = if data == NULL {FALSE} {data != ""}!;
+        if more {io.write s data!} {io.close s!}!;
+    }!;
+}!
+
+set replies 0
+set ended 0
+set client [n]:{
+    .c = io.connect "tcp" (strf "127.0.0.1:%s" <port>!) "rw"!;
+    .st = [sent = 1, got = 0];
+    io.write c "x"!;
+    io.loop.read c [s]:{
+        .r = io.read s 100!;
+        if r != NULL { st.got = st.got + (len r!); } {}!;
+        if st.got == st.sent {
+            replies = replies + 1;
+            if st.sent == msgs {
+                io.close s!;
+                ended = ended + 1;
+                if ended == clients { io.close server!; } {}!;
+            }{
+                st.sent = st.sent + 1;
+                io.write s "x"!;
+            }!;
+        } {}!;
+    }!;
+}
+
+set t timed {
+    for <1..clients> [n]:{ client n!; }!;
+    io.loop.run!
+}!
+printf "%d clients got %d replies in %dms\n" <clients, replies, t.ms>
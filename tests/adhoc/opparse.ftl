@@ -0,0 +1,40 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken to parse expressions using the standard operator
+# definitions, and using a set of definitions extended with many operators
+# whose names share prefixes.
+#
+# usage: ftl opparse.ftl
+
+source bench.ftl
+
+set parses 20000
+
+set expr {1 + 2 * 3 - 4 / 2 + (5 - 3) * 7 == 19 and 3 lt 4 or not 5 ge 6 and 7 != 8}
+
+# time <parses> parses of <expr> using operators <opdefs>
+set timeparse[opdefs]:{
+    timeloop parses [i]:{ parse.opeval opdefs expr! }!
+}
+
+# a copy of the standard operators with <n> more at each precedence
+set extended[n]:{
+    .ops = <>;
+    forall parse.op [precfns, prec]:{
+        forall precfns [precfn, name]:{
+            parse.opset ops prec precfn.assoc name precfn.fn!;
+        }!;
+        for <1..n> [i]:{
+            parse.opset ops prec parse.assoc."xfy" (strf "<%d>" <i>!) [x,y]:{x}!;
+            parse.opset ops prec parse.assoc."xfy" (strf "=%d=" <i>!) [x,y]:{y}!;
+        }!;
+    }!;
+    ops
+}
+
+printf "result %v\n" <parse.opeval parse.op expr!>
+printf "standard operators:      %5dms for %d parses\n" <ms (timeparse parse.op!)!, parses>
+forall <10, 100> [n]:{
+    printf "%3d more per precedence: %5dms for %d parses\n"
+           <n, ms (timeparse (extended n!)!)!, parses>!;
+}
@@ -0,0 +1,40 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the speedup gained by running a function in parallel.
+#
+# The same function is applied to every entry of a vector sequentially (with
+# 'select') and then with 'par.map' using 1, 2, 4 ... threads up to the number
+# of processors available.
+#
+# usage: ftl par.ftl
+
+source bench.ftl
+
+set items 64
+
+# a function that takes a while (it can use only what it binds itself)
+set work[x]:{
+    .fib = [f,n]:{ if (less n 2!) {n} {(f f (n-1)!) + (f f (n-2)!)}! };
+    fib fib 16!
+}
+
+set time[name, fn]:{
+    .t = timed fn!;
+    printf "%-12s %6dms (%d)\n" <name, t.ms, len t.val!>!;
+    t.ms
+}
+
+set seq (time "sequential" { select work <1..items>! }!)
+
+set speedups[seq]:{
+    .threads = 1;
+    while { lesseq threads (par.workers!)! } {
+        par.limit threads!;
+        .took = time (strf "par %d" <threads>!) { par.map <1..items> work! }!;
+        printf "%-12s %6d%%\n" <"  speedup", seq*100/took>!;
+        threads = threads*2;
+    }!;
+    par.limit 0!;
+}
+
+speedups seq
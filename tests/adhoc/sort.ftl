@@ -0,0 +1,30 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken to sort vectors in different ways.
+#
+# 'sort' compares values natively (sorting large vectors in several threads),
+# 'sortby' calls a comparison function for each comparison and 'sortbykey'
+# calls a key function once for each value then compares keys natively.
+#
+# usage: ftl sort.ftl
+
+source bench.ftl
+
+set items 20000
+set bigitems 400000
+
+set time[name, fn]:{
+    .t = timed fn!;
+    printf "%-10s %6dms (%d)\n" <name, t.ms, len t.val!>!;
+}
+
+rndseed 42
+set vals <>
+for <1..items> [i]:{ vals.(i) = rnd 1000000!; }
+set bigvals <>
+for <1..bigitems> [i]:{ bigvals.(i) = rnd 1000000!; }
+
+time "sort" { sort vals! }
+time "sortby" { sortby [a,b]:{ a - b } vals! }
+time "sortbykey" { sortbykey [v]:{ 0 - v } vals! }
+time "sort big" { sort bigvals! }
@@ -0,0 +1,45 @@
+#!/usr/bin/env ftl
+
+# Benchmark: a workload that creates many short strings by splitting text
+# into words.
+#
+# Compare the time, peak memory and allocations of different builds.  The
+# values allocated are counted from sys.gc.stats: a string's characters are
+# counted only if they are held in the value.  Run it with a malloc counter
+# (e.g. an LD_PRELOAD shim) to count separate allocations too.
+#
+# usage: ftl strshort.ftl
+
+source bench.ftl
+
+set reps 200
+set sizes <10, 100, 1000>
+
+# a line of <n> short words
+set mkline[n]:{
+    .words = <>;
+    for <1..n> [i]:{ words.(i) = "word$i"; }!;
+    join " " words!
+}
+
+# <reps> splits of <line>, all kept
+set splits[line]:{
+    .kept = <>;
+    for <1..reps> [rep]:{ kept.(rep) = split " " line!; }!;
+    kept
+}
+
+forall sizes [n]:{
+    .line = mkline n!;
+    printf "%5d words: %5dms for %d splits\n"
+           <n, (timed []:{ splits line! }!).ms, reps>!;
+}
+printf "peak RSS:    %5dkB\n" <peakrss!>
+
+# (garbage is kept while allocations are counted)
+forall sizes [n]:{
+    .line = mkline n!;
+    .a = allocated []:{ splits line! }!;
+    printf "%5d words: %7d values %9d bytes for %d splits\n"
+           <n, a.values, a.bytes, reps>!;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken to allocate, keep and then collect many small
+# values of different types (integers, strings and directories).
+#
+# Compare builds made with FTL_VALUE_SLABS set to 0 and to 1.
+#
+# usage: ftl valalloc.ftl
+
+source bench.ftl
+
+# build a vector of <size> entries each holding a few new values
+set mkkeep[size]:{
+    .v = <>;
+    for <1..size> [i]:{ v.(i) = <i*3, "s$i", [n=i]>; }!;
+    v
+}
+
+forall <1000, 10000, 100000> [size]:{
+    .t = timed []:{
+        for <1..200000/size> [rep]:{ mkkeep size!; }!;
+        sys.gc.collect!;
+    }!;
+    printf "%6d kept entries: %5dms for %d entries (%d slabs left)\n"
+           <size, t.ms, 200000, sys.gc.stats.slabs>!;
+}
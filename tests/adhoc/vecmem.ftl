@@ -0,0 +1,39 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the memory used by the values held in a vector of a million
+# integers (too large to be shared) and of a million reals.
+#
+# Memory is measured as the space in the slabs that hold the values, so
+# the build must have FTL_VALUE_SLABS set.  The vector's own storage (a
+# pointer per entry) is not included.
+#
+# usage: ftl vecmem.ftl
+
+source bench.ftl
+
+set entries 1000000
+
+set mkints[size]:{
+    .v = <>;
+    for <1..size> [i]:{ v.(i) = i+100000; }!;
+    v
+}
+
+set mkreals[size]:{
+    .v = <>;
+    for <1..size> [i]:{ v.(i) = i*1.5; }!;
+    v
+}
+
+set slabbytes[]:{ sys.gc.collect!; sys.gc.stats.slabs * 65536 }
+
+set measure[name, mk]:{
+    .before = slabbytes!;
+    .v = mk entries!;
+    .used = (slabbytes!) - before;
+    printf "%8d %s: %4dMB in slabs, %3d bytes per entry\n"
+           <entries, name, used/1048576, used/entries>!;
+}
+
+measure "integers" mkints
+measure "reals" mkreals
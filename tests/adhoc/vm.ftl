@@ -0,0 +1,41 @@
+#!/usr/bin/env ftl
+
+# Benchmark: the time taken to execute statements in code bodies.
+#
+# Compare the ways code can be executed by running this with each of
+#     ftl --exec text vm.ftl
+#     ftl --exec tree vm.ftl
+#     ftl --exec vm vm.ftl
+#
+# usage: ftl [--exec text|tree|vm] vm.ftl
+
+source bench.ftl
+
+set loops 200000
+
+# arithmetic on local variables
+set arith[n]:{
+    .total = 0;
+    for <1..n> [i]:{ total = total + i*2 - (i/3); }!;
+    total
+}
+
+# calls of a small closure
+set inc[x]:{ x + 1 }
+set calls[n]:{
+    .total = 0;
+    for <1..n> [i]:{ total = inc (inc total!)!; }!;
+    total
+}
+
+# recursion
+set fib[n]:{ if (less n 2!) {n} {(fib (n-1)!) + (fib (n-2)!)}! }
+
+set time[name, fn]:{
+    .t = timed fn!;
+    printf "%-8s %6dms (%d)\n" <name, t.ms, t.val>!;
+}
+
+time "arith" { arith loops! }
+time "calls" { calls loops! }
+time "fib" { fib 22! }
@@ -223,3 +223,8 @@ eval A.method!
 eval B.method!
 A method
 B method
+# closures can share integer argument names
+set a [1,2]:{3}
+set b [2,1]:{3}
+a
+b
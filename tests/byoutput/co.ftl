@@ -0,0 +1,67 @@
+# Coroutines taking turns in a single thread
+
+set log <>
+set add [s]:{ log.(len log!) = s; }
+set worker [name, n]:{
+    for <1..n> [i]:{ add (strf "%s %d" <name,i>!)!; co.yield!; }!;
+}
+eval co.count!
+eval co.go (worker "a" 3)!
+eval co.go (worker "b" 2)!
+eval co.count!
+eval co.run!
+eval log
+eval co.count!
+
+# sleeping lets the others run
+set log <>
+eval co.go {sleep 60!; add "slept 60"!}!
+eval co.go {sleep 20!; add "slept 20"!}!
+eval co.go {add "no sleep"!}!
+eval co.run!
+eval log
+
+# coroutines can start others
+set log <>
+eval co.go {
+    add "outer"!;
+    co.go {add "inner"!; co.yield!; add "inner again"!}!;
+    co.yield!;
+    add "outer again"!;
+}!
+eval co.run!
+eval log
+
+# values are kept while their coroutines wait
+set mk [n]:{
+    .v = <>;
+    for <1..n> [i]:{ v.(i-1) = <i, strf "%d" <i>!>; co.yield!; }!;
+    v
+}
+set sums []
+set w [k]:{
+    .v = mk (100+k)!;
+    .s = 0;
+    for v [x]:{ s = s + x.0 + (len x.1!); co.yield!; }!;
+    sums.(strf "w%d" <k>!) = s;
+}
+for <0..5> [k]:{ co.go (w k)!; }
+eval co.run!
+eval sums
+
+# exceptions end only their own coroutine
+eval co.go {throw "oops"!}!
+eval co.go {add "after"!}!
+eval co.run!
+eval log.((len log!) - 1)
+eval co.go {co.run!}!
+eval co.run!
+
+# coroutines have stacks as large as the main one by default
+set rec [n]:{ if (more n 0!) {1 + (rec (n-1)!)} {0}! }
+set res <0>
+eval co.go { res.0 = rec 600!; }!
+eval co.run!
+eval res
+eval co.stack 262144!
+eval co.stack 0!
@@ -3,3 +3,18 @@ code [b=1,a]:{a+b}
 
 code (bind [a]:{a+b} 1!)
 
+
+# compiled code bodies follow changes to the operator definitions
+set f[x]:{x + 1}
+f 2
+set plus parse.op.(10)."+"
+set parse.op.(10)."+" [fn=mul, assoc=parse.assoc."yfx"]
+f 5
+set parse.op.(10)."+" plus
+f 5
+set g[x]:{x * 2}
+g 4
+set parse.op.(11)."*".fn add
+g 4
+set parse.op.(11)."*".fn mul
+g 4
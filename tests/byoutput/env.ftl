@@ -30,3 +30,27 @@ inenv ids.[x="i", y="b"] "y"
 set ix[]:{<"local">.0}
 ix
 # "local" (fails in some pre 1.29 builds)
+
+# names written in code and names built at run time find the same bindings
+set many [a1=1,a2=2,a3=3,a4=4,a5=5,a6=6,a7=7,a8=8,a9=9,a10=10]
+eval many.(strf "a%d" <9>!)
+set many.(strf "b%d" <1>!) 11
+eval many.b1
+eval <many.a10, many."a10", many.(strf "a%d" <10>!)>
+
+# the same code finds names in whichever environment it is run in
+set x 1
+set c {x}
+set d [x=2]
+eval c!
+eval (d::c)!
+eval c!
+set e [y=3]
+set e.x 4
+eval (e::c)!
+set sh[x]:{ c! }
+sh 99
+eval c!
+set g[]:{ .r = <>; for <1..3> [i]:{ r.(i) = c!; x = x+1; }!; r }
+g
+eval c!
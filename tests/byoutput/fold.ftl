@@ -0,0 +1,30 @@
+# Test that operators with constant arguments give the same values when
+# compiled code evaluates them in advance
+
+set shifted[x]:{x * (1 shl 12) + 0x100}
+shifted 2
+shifted 0
+set mixed {(7 rem 2) + (2 ** 3) - (1.5 * 2)}
+mixed
+set cmp {not (1 == 2) and (3 _le_ 4)}
+cmp
+set strings {"abc" == "abc"}
+strings
+set nested {((1 + 2) * (3 + 4))}
+nested
+set twice[n]:{n + (10 - 4) + (10 - 4)}
+twice 1
+twice 2
+
+# arguments that would give an error are left until the code is run
+set badarg {1 + "a"}
+echo "before bad argument"
+badarg
+
+# redefining an operator changes compiled code that uses it
+set sum {5 + 2 + 1}
+sum
+parse opset parse.op 10 parse.assoc.xfy "+" [a,b]:{sub a b!}
+sum
+parse opset parse.op 10 parse.assoc.xfy "+" add
+sum
@@ -0,0 +1,60 @@
+# Directories made for calls are reused only when nothing has kept them
+
+# closures made inside a builtin's argument keep their environments
+set fs <>
+for <1..3> [i]:{ if (i != 2) { fs.(i) = []:{ i*10 }; } {}!; }
+eval fs.1!
+# 10
+eval fs.3!
+# 30
+
+# values given to code bodies that have no environment of their own
+set vals <>
+for <1..3> [i]:{ if TRUE { .v = i; vals.(i) = []:{v}; } {}!; }
+eval <vals.1!, vals.2!, vals.3!>
+# <1, 2, 3>
+
+# the environment returned by 'local' is kept
+set locs <>
+for <1..3> [i]:{ locs.(i) = parse.local!; }
+eval <locs.1.i, locs.3.i>
+# <1, 3>
+
+# builtins called again after their frames have been reused
+set count[n]:{
+    .sum = 0;
+    for <1..n> [i]:{ if (i rem 2 == 0) { sum = sum + (len "ab"!); } {}!; }!;
+    sum
+}
+count 1000
+# 1000
+
+# closures made in a function keep the environment binding its arguments
+set mk[a]:{ []:{ a*10 } }
+set ks <>
+for <1..3> [i]:{ ks.(i) = mk i!; }
+eval <ks.1!, ks.2!, ks.3!>
+# <10, 20, 30>
+
+# as does the environment returned by 'local' in a function
+set envof[a, b]:{ parse.local! }
+set es <>
+for <1..3> [i]:{ es.(i) = envof i (i*2)!; }
+eval <es.1.a, es.1.b, es.3.a, es.3.b>
+# <1, 2, 3, 6>
+
+# and one a function has added a variable to
+set add[a]:{ .b = a+1; []:{ b } }
+set bs <>
+for <1..3> [i]:{ bs.(i) = add i!; }
+eval <bs.1!, bs.3!>
+# <2, 4>
+
+# functions called again after their argument environments have been reused
+set fib[n]:{ if (less n 2!) {n} {(fib (n-1)!) + (fib (n-2)!)}! }
+eval fib 15!
+# 610
+set after[n]:{ n }
+set chain[n]:{ if (n == 0) {0} { after (n-1)!; chain (n-1)! }! }
+eval <chain 100!, after 7!>
+# <0, 7>
@@ -14,3 +14,47 @@ eval &auto 1 2
 # []:{a+b}
 eval &auto 1 2 !
 # 3
+
+# builtin functions given all, some or none of their arguments
+add 3 4
+set add3 add 3
+add3 4
+set later &add 3 4
+eval (later!)
+set addfn add
+addfn 5 6
+eval (add 1 2!) + (add3 (add 1 1!)!)
+eval <len (split "," "a,b,c"!)!, len <add 1 2!, add 3 4!>!>
+add 1 2 3
+
+# arguments for a function delivered together
+set args4[a,b,c,d]:{<a,b,c,d>}
+func autoargs4[a,b,c,d]:{<a,b,c,d>}
+args4 1 2 3 4
+autoargs4 1 2 3 4
+set args2 autoargs4 1 2
+args2 3 4
+typename (&autoargs4 1 2 3 4)
+set sameargs[a,b,a]:{<a,b>}
+sameargs 1 2 3
+set localargs[a,b]:{.c = a+b; <a,b,c>}
+localargs 1 2
+
+# calls at the end of a function body do not nest
+set count[n, acc]:{ if (n == 0) {acc} {count (n-1) (acc+1)!}! }
+count 100000 0
+set countdown[n]:{ if (n == 0) {"done"} {countdown (n-1)!}! }
+countdown 100000
+set even[n]:{ if (n == 0) {TRUE} {odd (n-1)!}! }
+set odd[n]:{ if (n == 0) {FALSE} {even (n-1)!}! }
+even 100001
+set twice[n]:{ .m = n*2; args4 n m 0 0! }
+twice 4
+set lastval[n]:{ if (n == 0) {"end"} {lastval (n-1)!}!; }
+lastval 3
+set throwat[n]:{ if (n == 0) {throw "bottom"!} {throwat (n-1)!}! }
+catch [ex]:{ ex } { throwat 10000! }
+func autoran[]:{"ran"}
+set mkauto[]:{ &autoran }
+set tailauto[]:{ mkauto! }
+tailauto
@@ -0,0 +1,37 @@
+sys gc help
+sys gc config young
+sys gc config growth
+sys gc config limit
+
+# collection is made only after this many values have been allocated
+set sys.gc.config.young 100
+sys gc config young
+
+set full 0+sys.gc.stats.full
+sys gc collect
+eval (sys.gc.stats.full) - full
+eval (sys.gc.stats.allocated) lt 100
+
+# a build-up of values is collected during a long command
+set collections 0+sys.gc.stats.collections
+for <1..1000> [i]:{ [n=i] }
+eval ((sys.gc.stats.collections) - collections) gt 5
+
+# allocations fail while the heap can not be collected below its limit
+set keep <>
+set sys.gc.config.limit 20000
+for <1..30000> [i]:{ keep.(i) = [n=i]; }
+set sys.gc.config.limit 0
+sys gc collect
+eval (len keep!) lt 30000
+set keep <>
+sys gc config limit
+
+set sys.gc.config.young 1024
+
+# data nested too deeply to be marked by recursion can be collected
+set mklist[n]:{ .l = NULL; for <1..n> [i]:{ l = [v=i, next=l]; }!; l }
+set listlen[l]:{ .n = 0; while {l != NULL} { n = n+1; l = l.next; }!; n }
+set deep mklist 100000!
+sys gc collect
+listlen deep
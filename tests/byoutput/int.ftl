@@ -15,3 +15,17 @@ int 0x2a
 # 42
 int 0o52
 # 42
+
+# small integers are not allocated but must behave like any others
+eval <-129, -128, 1023, 1024, 1022+1, 1022+2, (-127)-1, (-127)-2>
+set n 1023
+eval <n, n+1, n-1>
+# ... including those updated in structures
+set sys.gc.config.young 5
+sys gc config young
+set sys.gc.config.young 100000
+sys gc config young
+set sys.gc.config.young 6
+sys gc config young
+eval n
+set sys.gc.config.young 1024
@@ -0,0 +1,91 @@
+# io.loop calling functions for streams that are ready
+
+set log <>
+set add [s]:{ log.(len log!) = s; }
+eval io.loop.count!
+eval io.loop.run!
+
+# streams must have file descriptors
+eval io.loop.read (io.instring "abc" "r"!) [s]:{ add "never"!; }!
+eval io.loop.count!
+
+# regular files are always ready
+set f io.file "log" "w"!
+eval io.loop.write f [s]:{
+    io.write s "line 1\nline 2\n"!;
+    io.loop.write s NULL!;
+    add "written"!;
+}!
+eval io.loop.run!
+io close f
+set f io.file "log" "r"!
+eval io.loop.read f [s]:{
+    .text = io.read s 4!;
+    if (text == "") {io.loop.remove s!; add "end"!}
+                    {add (strf "read %s" <text>!)!}!;
+}!
+eval io.loop.count!
+eval io.loop.run!
+eval log
+eval io.loop.count!
+io close f
+
+# stop makes run return leaving streams registered
+set log <>
+set f io.file "log" "r"!
+eval io.loop.read f [s]:{ add (io.read s 7!)!; io.loop.stop!; }!
+eval io.loop.run!
+eval log
+eval io.loop.count!
+eval io.loop.run!
+eval log
+io close f
+eval io.loop.count!
+
+# an echo server and its clients on a local port
+set got []
+set port "47190"
+set server io.loop.accept "tcp" port "rw" [conn]:{
+    io.loop.read conn [s]:{
+        .msg = io.read s 100!;
+        if (msg == "") {io.close s!}
+                       {io.write s (strf "echo %s" <msg>!)!}!;
+    }!;
+}!
+set client [n]:{
+    .c = io.connect "tcp" (strf "localhost:%s" <port>!) "rw"!;
+    io.write c (strf "msg %d" <n>!)!;
+    io.loop.read c [s]:{
+        got.(io.read s 100!) = TRUE;
+        io.close s!;
+        if ((len got!) == 3) {io.close server!} {}!;
+    }!;
+}
+for <1..3> [n]:{ client n!; }
+eval io.loop.count!
+eval io.loop.run!
+sortdom got
+eval io.loop.count!
+
+# run waits as a coroutine would when there are others
+set got []
+set port "47191"
+set server io.loop.accept "tcp" port "rw" [conn]:{
+    io.loop.read conn [s]:{
+        .msg = io.read s 100!;
+        if (msg == "") {io.close s!}
+                       {io.write s (strf "echo %s" <msg>!)!}!;
+    }!;
+}!
+eval co.go {io.loop.run!}!
+set client [n]:{
+    .c = io.connect "tcp" (strf "localhost:%s" <port>!) "rw"!;
+    io.write c (strf "co %d" <n>!)!;
+    got.(io.read c 100!) = TRUE;
+    io.close c!;
+}
+for <1..4> [n]:{ co.go (client n)!; }
+eval co.go {while {less (len got!) 4!} {sleep 10!}!; io.close server!}!
+eval co.run!
+sortdom got
+eval io.loop.count!
@@ -0,0 +1,21 @@
+# Test that operators on integer and real values give the same results as
+# the functions that implement them
+
+set ops[a,b]:{ <a + b, a - b, a * b, a / b> }
+set cmps[a,b]:{ <a == b, a != b, a lt b, a le b, a gt b, a ge b> }
+ops 7 2
+ops -7 2
+ops 7 2.0
+ops 7.5 2
+ops 0.5 0.25
+ops 0x7fffffffffffffff 1
+cmps 1 2
+cmps 2 2
+cmps 3 2
+cmps 2 2.0
+cmps 1.5 2
+cmps 2.5 2.5
+# values that are not numbers use the functions
+cmps "a" "b"
+ops 3 "b"
+ops 6 0.0
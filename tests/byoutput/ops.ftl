@@ -88,3 +88,43 @@ set printf io.fprintf io.out
 forops parse.op [name, prec, assoc, fn]:{
     printf "%3d: %3s %v\n" <prec, assocstr assoc!, name>!;
 }
+
+# operators whose names share a prefix
+set ops <>
+parse opset ops 8 parse.assoc."xfy" "_p_p_" [x,y]:{x*y}
+parse opset ops 8 parse.assoc."xfy" "_p_" [x,y]:{x+y}
+parse opset ops 9 parse.assoc."xfy" "_p_q_" [x,y]:{x-y}
+set opdef range ops!
+parse opeval opdef {2 _p_p_ 5}
+parse opeval opdef {2 _p_ 5}
+parse opeval opdef {2 _p_q_ 5 _p_ 1}
+parse opeval opdef {2 _p_ 5 _p_q_ 1}
+
+# redefining an operator affects subsequent parsing
+parse opset ops 8 parse.assoc."xfy" "_p_" [x,y]:{x-y}
+set opdef range ops!
+parse opeval opdef {2 _p_ 5}
+
+# changing operator definitions directly affects subsequent parsing
+set ops <>
+parse opset ops 8 parse.assoc."xfy" "_sb_" sub
+set opdef range ops!
+parse opeval opdef {20 _sb_ 4}
+set opdef.0._sb_ [fn=add, assoc=parse.assoc."xfy"]
+parse opeval opdef {20 _sb_ 4}
+set opdef.0._ad_ [fn=add, assoc=parse.assoc."xfy"]
+parse opeval opdef {20 _ad_ 4}
+set opdef.1 [_mu_=[fn=mul, assoc=parse.assoc."xfy"]]
+parse opeval opdef {20 _mu_ 4 _ad_ 1}
+set opdef.0._sb_.fn sub
+parse opeval opdef {20 _sb_ 4}
+set redef[fn]:{ opdef.0._sb_.fn = fn; }
+redef add
+parse opeval opdef {20 _sb_ 4}
+
+# including the interpreter's own operators
+set plus parse.op.(10)."+"
+set parse.op.(10)."+" [fn=mul, assoc=parse.assoc."yfx"]
+eval 5 + 1
+set parse.op.(10)."+" plus
+eval 5 + 1
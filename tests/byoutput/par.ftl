@@ -0,0 +1,53 @@
+# Functions applied to directories by threads with interpreters of their own
+
+eval par.map <1,2,3,4,5> [x]:{x*x}!
+eval par.map [a=1,b=2] [v,n]:{<n,v>}!
+eval par.map <1..20> [x]:{x*x - x}!
+eval par.map (intseq 1 2 7!) [x]:{x*x}!
+eval par.map <> [x]:{x}!
+
+# values and functions are copied between threads
+eval par.map <1.5,"s\n\"q",[a=1],{code},NULL,TRUE,<1,<2>>> [x]:{x}!
+eval par.map <1..4> ([x]:{x*k})::[k=3]!
+set f[n]:{ par.map <1,2> [x]:{x*n}! }
+eval f 3!
+eval (par.map <1,2> [x]:{[y]:{x+y}}!).1 5!
+set r 1.0/3.0
+eval (par.map <r> [x]:{x}!).0 == r
+set r 123456789.123456789
+eval (par.map <r> [x]:{x}!).0 == r
+set d [a=1]
+set d.self d
+eval (par.map <d> [x]:{x}!).0.self.self.a
+eval par.map <sys.env> [e]:{equal e.HOME sys.env.HOME!}!
+
+# closures can use values set in the caller's root
+set g[y]:{y+1}
+eval par.map <1,2> [x]:{g x!}!
+set fact[n]:{ if (more n 1!) {n * (fact (n-1)!)} {1}! }
+eval par.map <3,5> fact!
+eval par.map <1,2> str!
+
+# errors are reported where they happened in the caller's source
+eval par.map <1> [x]:{
+    undefined_in_par
+}!
+
+# reductions combine the values in order
+eval par.reduce <1..1000> [a,b]:{a+b} 0!
+set digits par.map <1..100> [x]:{str x!}!
+eval par.reduce digits [a,b]:{join "" <a,b>!} ""!
+eval par.reduce <> [a,b]:{a+b} 7!
+
+eval par.forall <1,2> [x]:{x}!
+eval par.map <1,2> [x]:{par.map <x,x> [y]:{y*2}!}!
+
+# exceptions are thrown again in the caller
+set try[fn]:{
+    catch [ex]:{ io.fprintf io.out "Exception: %v\n" <ex>!; "caught" } fn!
+}
+eval try { par.map <1,2,3> [x]:{if (x==2) { throw <"bad",x>! } {x}!}! }!
+
+set old (par.limit 1!)
+eval par.map <1..5> [x]:{x*2}!
+eval par.limit old!
@@ -0,0 +1,8 @@
+eval select [v]:{ equal "int" (typename v!)! } <1,2,"this",4,"that">!
+eval select [v,n]:{ equal n "b"! } [a=1, b=2, c=3]!
+# closures binding only the value are invoked after their last substitution
+set big select [v]:{ more v 190! } <1..200>!
+len big
+set n 0
+forall <1..200> [v]:{ n = n + (len (strf "%d-%d" <v, v>)!); }
+n
@@ -0,0 +1,40 @@
+# sort, sortby, sortbykey and their domain versions
+
+set v <5, 3, 9, 1, 7>
+sort v
+sortby [a,b]:{b-a} v
+sortdom [c=3, a=1, b=2]
+sortdomby [a,b]:{cmp b a!} [c=3, a=1, b=2]
+sortbykey [x]:{-x} v
+
+# sort is stable - equal values keep their original order
+set ties <2, 1, 2, 1, 2, 0>
+sort ties
+sortby [a,b]:{0} ties
+sortbykey [x]:{x rem 2} <4, 3, 2, 1, 0>
+
+# mixed types and strings
+sort <"b", "a", "c">
+sort [z="pear", y="apple", x="fig"]
+
+# comparators with some arguments already bound
+set by [d,a,b]:{cmp (d*a) (d*b)!}
+sortby (by (-1)) v
+sortby (by 1) v
+# a builtin comparator
+sortby cmp v
+
+# comparators can themselves sort
+set inner [a,b]:{(sort <a,b>!).0 - 1}
+sortby inner <3, 1, 2>
+sortby [a,b]:{cmp (sort a!).0 (sort b!).0!} <<2,9>, <8,0>, <5,4>>
+
+# the key function is called once per item
+set calls 0
+sortbykey [x]:{calls = calls + 1; x} <4, 3, 2, 1, 0>
+echo ${calls}
+
+# empty environments
+sort <>
+sortby cmp <>
+sortbykey [x]:{x} []
@@ -243,7 +243,8 @@ usage(const char* msg)
         fprintf(stderr, "error: %s\n", msg);
 
     fprintf(stderr, "\nusage:\n");
-    fprintf(stderr, "  "CODEID" [-e|-ne|-ep] [-s] [--version] [-c <cmds> | [-f <file>]\n"
+    fprintf(stderr, "  "CODEID" [-e|-ne|-ep] [-s] [--version] [--exec <how>]\n"
+            "      [-c <cmds> | [-f <file>]\n"
             "      [[--] <script arg>...]\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "     -s                  - run without interactive prompts\n");
@@ -257,6 +258,10 @@ usage(const char* msg)
                     "don't report unnecessary info\n");
     fprintf(stderr, "     --version           - "
                     "just print version number and quit\n");
+    fprintf(stderr, "     --exec text|tree|vm - "
+                    "execute code by parsing its text, walking its\n"
+                    "                           compiled tree or running "
+                    "its bytecode (default)\n");
     exit(1);
 }
 
@@ -314,6 +319,18 @@ parse_args(int argc, char **argv,
                 parse_empty(&arg))
                 *out_do_version = TRUE;
             else
+            if (parse_key(&arg, "--exec") && parse_empty(&arg))
+            {   if (++argn >= argc)
+                    err = "ran out of arguments";
+                else if (0 == strcmp(argv[argn], "text"))
+                    code_exec_mode_set(code_exec_text);
+                else if (0 == strcmp(argv[argn], "tree"))
+                    code_exec_mode_set(code_exec_tree);
+                else if (0 == strcmp(argv[argn], "vm"))
+                    code_exec_mode_set(code_exec_vm);
+                else
+                    err = "code execution must be text, tree or vm";
+            } else
             if ((parse_key(&arg, "-ep") || parse_key(&arg, "--emitprolog")) &&
                 parse_empty(&arg))
             {   *out_echo = TRUE;
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2013-2021, Gray Girling
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************\
+*//*! \file
+** \author  cgg
+**  \brief  tools/ftlstress  Runs FTL interpreters concurrently
+*//*
+\**************************************************************************/
+
+/* Runs many FTL interpreters at once, each in a thread of its own, over a set
+   of FTL scripts.
+
+   Each script is first run on its own to find how many errors it reports.
+   Then every thread runs every script (each in a new interpreter) a number of
+   times, starting at a different script, and checks that the same number of
+   errors is reported.  The scripts' output is written to stdout by all the
+   threads at once so it is not compared (-q discards it).
+
+   Scripts that change state shared by the whole process (e.g. files or the
+   current directory) should not be used.
+*/
+
+
+
+
+
+
+/*****************************************************************************
+ *                                                                           *
+ *          Headers                                                          *
+ *          =======							     *
+ *                                                                           *
+ *****************************************************************************/
+
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>     /* for dup */
+#define NULL_DEVICE "NUL"
+#else
+#include <unistd.h> /* for dup */
+#define NULL_DEVICE "/dev/null"
+#endif
+
+#include "ftl.h"
+
+
+
+
+/*****************************************************************************
+ *                                                                           *
+ *          Configuration                                                    *
+ *          =============						     *
+ *                                                                           *
+ *****************************************************************************/
+
+
+
+#define CODEID "ftlstress"
+
+#define STRESS_THREADS_DEFAULT 8
+#define STRESS_THREADS_MAX     64
+#define STRESS_ROUNDS_DEFAULT  2
+
+#define STRESS_STACK_SIZE (8<<20) /* interpreters can recurse deeply */
+
+#define EXIT_OK        0
+#define EXIT_BAD_ARGS  1
+#define EXIT_MISMATCH  2
+#define EXIT_BAD_START 3
+
+
+
+
+static FILE *results = NULL; /* where to write the results */
+
+
+
+
+const char prolog_text[] =  /* ends with 'text end - penv_text' comment */
+#include "ftl_fns.str"
+    "";
+
+
+
+
+/*****************************************************************************
+ *                                                                           *
+ *          Interpreter Runs                                                 *
+ *          ================						     *
+ *                                                                           *
+ *****************************************************************************/
+
+
+
+/*! Run a script in a new interpreter
+ *  Returns the number of errors reported, or -1 if it could not be run
+ */
+static int
+stress_run(const char *script)
+{   const char *argv[] = { CODEID };
+    dir_t *root = dir_id_lnew(NULL);
+    parser_state_t *state = parser_state_lnew(NULL, root);
+    int errors = -1;
+
+    value_unlocal(dir_value(root));
+    if (NULL != state)
+    {   charsource_t *prolog =
+            charsource_cstring_new("prolog", &prolog_text[0],
+                                   strlen(&prolog_text[0]));
+        charsource_t *fin = charsource_file_path_new(NULL, script,
+                                                     strlen(script));
+
+        cmds_generic(state, 1, &argv[0]);
+        if (NULL != prolog &&
+            NULL != parser_expand_exec(state, prolog, /*cmd_str*/NULL,
+                                       /*rc_file_id*/NULL, /*no_locals*/TRUE)
+            && NULL != fin)
+        {   const value_t *retval =
+                parser_expand_exec(state, fin, /*cmd_str*/NULL,
+                                   /*rc_file_id*/NULL, /*no_locals*/TRUE);
+            if (NULL != retval)
+            {   errors = parser_error_count(state);
+                value_unlocal(retval);
+            }
+        }
+        cmds_generic_end(state);
+        parser_state_free(state);
+    }
+    return errors;
+}
+
+
+
+
+typedef struct
+{   thread_work_t work;         /**< must be first */
+    int id;                     /**< index of this thread */
+    int rounds;                 /**< times to run every script */
+    int scripts;                /**< number of scripts */
+    const char **script;        /**< script file names */
+    const int *errors;          /**< errors expected from each script */
+    int mismatches;             /**< runs with unexpected errors */
+} stress_thread_t;
+
+
+
+
+static unsigned
+stress_thread_main(void *arg)
+{   stress_thread_t *thread = (stress_thread_t *)arg;
+    int round;
+
+    for (round = 0; round < thread->rounds; round++)
+    {   int i;
+        for (i = 0; i < thread->scripts; i++)
+        {   int s = (thread->id + i) % thread->scripts;
+            int errors = stress_run(thread->script[s]);
+
+            if (errors != thread->errors[s])
+            {   fprintf(results, "%s: thread %d round %d - '%s' reported "
+                        "%d errors not %d\n", CODEID, thread->id, round,
+                        thread->script[s], errors, thread->errors[s]);
+                thread->mismatches++;
+            }
+        }
+    }
+    return 0;
+}
+
+
+
+
+/*****************************************************************************
+ *                                                                           *
+ *          Main Program                                                     *
+ *          ============						     *
+ *                                                                           *
+ *****************************************************************************/
+
+
+
+static void
+usage(void)
+{   fprintf(stderr, "syntax: %s [-q] [-t <threads>] [-r <rounds>] "
+            "<script.ftl>...\n", CODEID);
+    fprintf(stderr, "    -q          discard the scripts' output\n");
+    fprintf(stderr, "    -t <n>      run <n> threads at once\n");
+    fprintf(stderr, "    -r <n>      run every script <n> times in each "
+            "thread\n");
+}
+
+
+
+
+extern int
+main(int argc, char **argv)
+{   int threads = STRESS_THREADS_DEFAULT;
+    int rounds = STRESS_ROUNDS_DEFAULT;
+    static stress_thread_t thread[STRESS_THREADS_MAX];
+    thread_os_t os_thread[STRESS_THREADS_MAX];
+    int *errors;
+    int scripts;
+    int mismatches = 0;
+    int started = 0;
+    int exit_rc = EXIT_OK;
+    bool quiet = FALSE;
+    int arg = 1;
+    int i;
+
+    while (arg < argc && argv[arg][0] == '-')
+    {   if (0 == strcmp(argv[arg], "-q"))
+            quiet = TRUE;
+        else if (arg+1 < argc && 0 == strcmp(argv[arg], "-t"))
+            threads = atoi(argv[++arg]);
+        else if (arg+1 < argc && 0 == strcmp(argv[arg], "-r"))
+            rounds = atoi(argv[++arg]);
+        else
+            break;
+        arg++;
+    }
+    scripts = argc - arg;
+    if (scripts <= 0 || threads <= 0 || threads > STRESS_THREADS_MAX ||
+        rounds <= 0)
+    {   usage();
+        return EXIT_BAD_ARGS;
+    }
+
+    results = stderr;
+    if (quiet)
+    {   FILE *err = fdopen(dup(fileno(stderr)), "w");
+        if (NULL != err)
+        {   results = err;
+            (void)freopen(NULL_DEVICE, "w", stdout);
+            (void)freopen(NULL_DEVICE, "w", stderr);
+        }
+    }
+
+    ftl_init();
+    codeid_set(CODEID);
+
+    errors = (int *)malloc(scripts * sizeof(int));
+    if (NULL == errors)
+        return EXIT_BAD_START;
+
+    for (i = 0; i < scripts; i++)
+        errors[i] = stress_run(argv[arg+i]);
+
+    for (i = 0; i < threads; i++)
+    {   thread[i].id = i;
+        thread[i].rounds = rounds;
+        thread[i].scripts = scripts;
+        thread[i].script = (const char **)&argv[arg];
+        thread[i].errors = errors;
+        thread[i].mismatches = 0;
+        os_thread[i] = thread_new(&stress_thread_main, &thread[i].work,
+                                  STRESS_STACK_SIZE);
+        if (THREAD_OS_BAD == os_thread[i])
+        {   fprintf(results, "%s: failed to start thread %d\n", CODEID, i);
+            exit_rc = EXIT_BAD_START;
+            break;
+        }
+        started++;
+    }
+
+    for (i = 0; i < started; i++)
+    {   if (!thread_wait(os_thread[i]))
+        {   fprintf(results, "%s: failed to wait for thread %d\n", CODEID, i);
+            exit_rc = EXIT_BAD_START;
+        }
+        mismatches += thread[i].mismatches;
+    }
+
+    fflush(stdout);
+    fprintf(results, "%s: %d threads ran %d scripts %d times - "
+            "%d unexpected results\n", CODEID, started, scripts, rounds,
+            mismatches);
+    if (exit_rc == EXIT_OK && mismatches > 0)
+        exit_rc = EXIT_MISMATCH;
+
+    free(errors);
+    ftl_end();
+    fflush(results);
+    return exit_rc;
+}
+
+
+
+
+/*
+ * Local variables:
+ *  c-basic-offset: 4
+ *  c-indent-level: 4
+ *  tab-width: 8
+ * End:
+ */